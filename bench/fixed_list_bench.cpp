@@ -0,0 +1,95 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "fixed_list.hpp"
+#include "ll.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// compares the startup cost of a static lookup table built
+// at runtime by appending to a LinkedList in a loop against
+// the same table built at compile time as a FixedList.
+
+const size_t table_size = 1024;
+const int num_runs = 1000;
+
+// num_allocs counts every call to operator new in this
+// program, so the benchmark can report heap use measured
+// rather than assumed
+atomic<size_t> num_allocs(0);
+
+void* operator new(size_t size) {
+    num_allocs++;
+    if (void* ptr = malloc(size)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t size) noexcept {
+    free(ptr);
+}
+
+// table_val is the value stored at idx in both tables
+constexpr long table_val(size_t idx) {
+    return long(idx) * long(idx) + 7;
+}
+
+// fixed_table is a constant expression, so the compiler
+// builds it and emits it into the binary's read only data.
+// there's no code left to run for it at startup.
+constexpr auto fixed_table = []() {
+    FixedList<long, table_size> ret;
+    for (size_t i = 0; i < table_size; ++i) {
+        ret.append(table_val(i));
+    }
+    return ret;
+}();
+
+shared_ptr<LinkedList<long>> build_linked_table() {
+    auto ret = make_shared<LinkedList<long>>();
+    for (size_t i = 0; i < table_size; ++i) {
+        ret->append(table_val(i));
+    }
+    return ret;
+}
+
+int main() {
+    // the runtime table has to be rebuilt from scratch on
+    // every startup, so time how long one build takes
+    long sink = 0;
+    size_t allocs_before = num_allocs.load();
+    auto start = chrono::steady_clock::now();
+    for (int run = 0; run < num_runs; ++run) {
+        auto table = build_linked_table();
+        sink += table->len();
+    }
+    const double linked_us =
+        chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / num_runs;
+    const size_t linked_allocs = (num_allocs.load() - allocs_before) / num_runs;
+
+    // summing the FixedList checks that it's really there and
+    // usable without any setup
+    allocs_before = num_allocs.load();
+    start = chrono::steady_clock::now();
+    sink += fixed_table.reduce<long>(0, [](size_t idx, const long& acc, const long& elt) {
+        return acc + elt;
+    });
+    const double fixed_us =
+        chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    const size_t fixed_allocs = num_allocs.load() - allocs_before;
+
+    printf("LinkedList build at startup   %10.2f us, %zu heap allocations\n", linked_us, linked_allocs);
+    printf("FixedList first full scan     %10.2f us, %zu heap allocations\n", fixed_us, fixed_allocs);
+    printf("(checksum %ld)\n", sink);
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ll.hpp"
+#include "lru_cache.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// benchmarks LRUCache against an LRU cache built by hand
+// on top of LinkedList, which is what callers did before
+// LRUCache existed. every run does a get for a random key
+// and, on a miss, a put of that key.
+
+const size_t capacity = 1024;
+const int key_range = 2048;
+
+vector<int> make_keys(size_t num_ops) {
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, key_range - 1);
+    vector<int> keys;
+    keys.reserve(num_ops);
+    for (size_t i = 0; i < num_ops; ++i) {
+        keys.push_back(dist(rng));
+    }
+    return keys;
+}
+
+void report(const char* name, size_t num_ops, size_t hits, chrono::steady_clock::duration elapsed) {
+    const double secs = chrono::duration<double>(elapsed).count();
+    printf(
+        "%-28s %10zu ops  %6.1f%% hits  %14.0f ops/sec\n",
+        name,
+        num_ops,
+        100.0 * double(hits) / double(num_ops),
+        double(num_ops) / secs
+    );
+}
+
+// the hand built cache keeps the most recently used entry
+// at the end of the list. a hit has to rebuild the list
+// without the entry and append it again, and both lookups
+// and the rebuild are O(N).
+void bench_linked_list(const vector<int>& keys) {
+    auto list = make_shared<LinkedList<pair<int, int>>>();
+    size_t hits = 0;
+    auto start = chrono::steady_clock::now();
+    for (auto key : keys) {
+        auto found = list->find([key](size_t idx, const pair<int, int>& entry) {
+            return entry.first == key;
+        });
+        if (found.has_value()) {
+            hits++;
+            list = list->filter([key](size_t idx, const pair<int, int>& entry) {
+                return entry.first != key;
+            });
+            list->append(found.value());
+            continue;
+        }
+        if (list->len() == capacity) {
+            list->pop();
+        }
+        list->append(make_pair(key, key));
+    }
+    report("LinkedList (hand built)", keys.size(), hits, chrono::steady_clock::now() - start);
+}
+
+void bench_lru_cache(const vector<int>& keys) {
+    LRUCache<int, int> cache(capacity);
+    size_t hits = 0;
+    auto start = chrono::steady_clock::now();
+    for (auto key : keys) {
+        if (cache.get(key).has_value()) {
+            hits++;
+            continue;
+        }
+        cache.put(key, key);
+    }
+    report("LRUCache", keys.size(), hits, chrono::steady_clock::now() - start);
+}
+
+void bench_sharded_lru_cache(const vector<int>& keys, size_t num_threads) {
+    ShardedLRUCache<int, int> cache(16, capacity);
+    vector<size_t> hits(num_threads, 0);
+    vector<thread> threads;
+    auto start = chrono::steady_clock::now();
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.push_back(thread([&cache, &keys, &hits, t, num_threads]() {
+            size_t local_hits = 0;
+            for (size_t i = t; i < keys.size(); i += num_threads) {
+                if (cache.get(keys[i]).has_value()) {
+                    local_hits++;
+                    continue;
+                }
+                cache.put(keys[i], keys[i]);
+            }
+            hits[t] = local_hits;
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto elapsed = chrono::steady_clock::now() - start;
+    size_t total_hits = 0;
+    for (auto h : hits) {
+        total_hits += h;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "ShardedLRUCache (%zu threads)", num_threads);
+    report(name, keys.size(), total_hits, elapsed);
+}
+
+int main() {
+    // the hand built cache is orders of magnitude slower,
+    // so it gets fewer operations to finish in a sane time
+    bench_linked_list(make_keys(20000));
+
+    auto keys = make_keys(5000000);
+    bench_lru_cache(keys);
+    bench_sharded_lru_cache(keys, 1);
+    bench_sharded_lru_cache(keys, 4);
+    return 0;
+}
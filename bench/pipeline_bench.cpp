@@ -0,0 +1,105 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "ll.hpp"
+#include "pipeline.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// benchmarks a map -> filter -> flatMap -> reduce chain run
+// sequentially on LinkedList against the same chain run on a
+// Pipeline at a few queue depths. for each run it reports
+// total throughput and latency, which is the time until the
+// first value reaches the reduce stage.
+
+const size_t num_elts = 1000000;
+
+// spin does a little bit of throwaway work per value so that
+// the stages cost something and have something to overlap
+uint64_t spin(uint64_t x) {
+    for (int i = 0; i < 50; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return x;
+}
+
+uint64_t map_stage(size_t idx, uint64_t elt) {
+    return spin(elt);
+}
+
+bool filter_stage(size_t idx, const uint64_t& elt) {
+    return spin(elt) % 4 != 0;
+}
+
+shared_ptr<LinkedList<uint64_t>> flat_map_stage(size_t idx, const uint64_t& elt) {
+    auto ret = make_shared<LinkedList<uint64_t>>();
+    ret->append(elt);
+    ret->append(spin(elt));
+    return ret;
+}
+
+void report(
+    const char* name,
+    uint64_t result,
+    chrono::steady_clock::time_point start,
+    chrono::steady_clock::time_point first,
+    chrono::steady_clock::time_point end
+) {
+    const double secs = chrono::duration<double>(end - start).count();
+    const double first_ms = chrono::duration<double, milli>(first - start).count();
+    printf(
+        "%-24s %14.0f elts/sec  %10.2f ms to first result  (result %llx)\n",
+        name,
+        double(num_elts) / secs,
+        first_ms,
+        (unsigned long long)result
+    );
+}
+
+void bench_sequential(const shared_ptr<LinkedList<uint64_t>> ll) {
+    auto start = chrono::steady_clock::now();
+    auto first = start;
+    auto result = ll->map<uint64_t>(map_stage)
+        ->filter(filter_stage)
+        ->flatMap<uint64_t>(flat_map_stage)
+        ->reduce<uint64_t>(0, [&first](size_t idx, const uint64_t& acc, const uint64_t& elt) {
+            if (idx == 0) {
+                first = chrono::steady_clock::now();
+            }
+            return acc ^ spin(elt);
+        });
+    report("sequential", result, start, first, chrono::steady_clock::now());
+}
+
+void bench_pipeline(const shared_ptr<LinkedList<uint64_t>> ll, size_t depth) {
+    auto start = chrono::steady_clock::now();
+    auto first = start;
+    auto result = Pipeline<uint64_t>::from(ll, depth)
+        .map<uint64_t>(map_stage)
+        .filter(filter_stage)
+        .flatMap<uint64_t>(flat_map_stage)
+        .reduce<uint64_t>(0, [&first](size_t idx, const uint64_t& acc, const uint64_t& elt) {
+            if (idx == 0) {
+                first = chrono::steady_clock::now();
+            }
+            return acc ^ spin(elt);
+        });
+    char name[64];
+    snprintf(name, sizeof(name), "pipeline (depth %zu)", depth);
+    report(name, result, start, first, chrono::steady_clock::now());
+}
+
+int main() {
+    auto ll = make_shared<LinkedList<uint64_t>>();
+    for (size_t i = 0; i < num_elts; ++i) {
+        ll->append(i);
+    }
+    bench_sequential(ll);
+    bench_pipeline(ll, 16);
+    bench_pipeline(ll, 256);
+    bench_pipeline(ll, 4096);
+    return 0;
+}
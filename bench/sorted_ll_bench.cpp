@@ -0,0 +1,148 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "ll.hpp"
+#include "sorted_ll.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// benchmarks SortedLinkedList's set operations against the
+// std::set round trip that callers used before it existed:
+// forEach the inputs into a std::set, then append the result
+// back out into a LinkedList.
+
+const size_t num_ids = 500000;
+
+// make_ids returns num_ids sorted, unique ids. ids are drawn
+// from a range twice as big as num_ids, so two id lists
+// overlap by about half.
+vector<int> make_ids(unsigned seed) {
+    mt19937 rng(seed);
+    set<int> ids;
+    uniform_int_distribution<int> dist(0, int(num_ids) * 2);
+    while (ids.size() < num_ids) {
+        ids.insert(dist(rng));
+    }
+    return vector<int>(ids.begin(), ids.end());
+}
+
+double millis_since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* op, double set_ms, double sorted_ms, size_t set_len, size_t sorted_len) {
+    printf(
+        "%-12s std::set %9.2f ms   SortedLinkedList %9.2f ms   (%zu / %zu elts)\n",
+        op,
+        set_ms,
+        sorted_ms,
+        set_len,
+        sorted_len
+    );
+}
+
+int main() {
+    auto ids1 = make_ids(1);
+    auto ids2 = make_ids(2);
+    auto ll1 = make_shared<LinkedList<int>>();
+    auto ll2 = make_shared<LinkedList<int>>();
+    auto sorted1 = make_shared<SortedLinkedList<int>>();
+    auto sorted2 = make_shared<SortedLinkedList<int>>();
+    for (size_t i = 0; i < num_ids; ++i) {
+        ll1->append(ids1[i]);
+        ll2->append(ids2[i]);
+        sorted1->insert(ids1[i]);
+        sorted2->insert(ids2[i]);
+    }
+
+    // union
+    {
+        auto start = chrono::steady_clock::now();
+        set<int> s;
+        ll1->forEach([&s](size_t idx, const int& id) { s.insert(id); });
+        ll2->forEach([&s](size_t idx, const int& id) { s.insert(id); });
+        auto out = make_shared<LinkedList<int>>();
+        for (auto id : s) {
+            out->append(id);
+        }
+        const double set_ms = millis_since(start);
+
+        // unionWith consumes its argument, so it works on
+        // copies made outside of the timed section
+        auto a = make_shared<SortedLinkedList<int>>(*sorted1);
+        auto b = make_shared<SortedLinkedList<int>>(*sorted2);
+        start = chrono::steady_clock::now();
+        a->unionWith(b);
+        report("union", set_ms, millis_since(start), out->len(), a->len());
+    }
+
+    // intersection
+    {
+        auto start = chrono::steady_clock::now();
+        set<int> s;
+        ll1->forEach([&s](size_t idx, const int& id) { s.insert(id); });
+        auto out = make_shared<LinkedList<int>>();
+        ll2->forEach([&s, &out](size_t idx, const int& id) {
+            if (s.count(id) > 0) {
+                out->append(id);
+            }
+        });
+        const double set_ms = millis_since(start);
+
+        auto a = make_shared<SortedLinkedList<int>>(*sorted1);
+        start = chrono::steady_clock::now();
+        a->intersect(sorted2);
+        report("intersect", set_ms, millis_since(start), out->len(), a->len());
+    }
+
+    // difference
+    {
+        auto start = chrono::steady_clock::now();
+        set<int> s;
+        ll2->forEach([&s](size_t idx, const int& id) { s.insert(id); });
+        auto out = make_shared<LinkedList<int>>();
+        ll1->forEach([&s, &out](size_t idx, const int& id) {
+            if (s.count(id) == 0) {
+                out->append(id);
+            }
+        });
+        const double set_ms = millis_since(start);
+
+        auto a = make_shared<SortedLinkedList<int>>(*sorted1);
+        start = chrono::steady_clock::now();
+        a->difference(sorted2);
+        report("difference", set_ms, millis_since(start), out->len(), a->len());
+    }
+
+    // inserting nearly sorted ids: every 16th id arrives a
+    // few places late
+    {
+        vector<int> near_sorted(ids1);
+        for (size_t i = 16; i < near_sorted.size(); i += 16) {
+            swap(near_sorted[i], near_sorted[i - 5]);
+        }
+        auto start = chrono::steady_clock::now();
+        set<int> s;
+        for (auto id : near_sorted) {
+            s.insert(id);
+        }
+        auto out = make_shared<LinkedList<int>>();
+        for (auto id : s) {
+            out->append(id);
+        }
+        const double set_ms = millis_since(start);
+
+        start = chrono::steady_clock::now();
+        SortedLinkedList<int> sorted;
+        for (auto id : near_sorted) {
+            sorted.insert(id);
+        }
+        report("insert", set_ms, millis_since(start), out->len(), sorted.len());
+    }
+    return 0;
+}
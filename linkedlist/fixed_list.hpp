@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdlib>
+#include <optional>
+
+namespace linkedlist {
+
+// FixedList is an array backed list that holds at most N
+// elements. it mirrors LinkedList's append, getters and
+// transformers, but everything it does is constexpr and it
+// never touches the heap, so a FixedList can be built
+// entirely at compile time and used as a static lookup
+// table. for example:
+//
+//     constexpr auto squares = []() {
+//         FixedList<int, 16> ret;
+//         for (int i = 0; i < 16; ++i) {
+//             ret.append(i * i);
+//         }
+//         return ret;
+//     }();
+//
+// T must be default constructible, since the backing array
+// is filled with default values up front. to be usable in a
+// constant expression it must also be a literal type.
+//
+// std::function can't be called in a constant expression, so
+// unlike LinkedList, the functions passed to forEach, find, map
+// and reduce are template parameters rather than the types in
+// ll_funcs.hpp. they're called with the same arguments.
+template <typename T, size_t N>
+class FixedList {
+    static_assert(N > 0, "FixedList capacity must be greater than 0");
+
+    private:
+        T elts[N];
+        size_t size;
+
+    public:
+
+        /////
+        // constructors
+        /////
+        constexpr FixedList(): elts(), size(0) {}
+
+        /////
+        // modifiers
+        /////
+
+        // append adds val to the end of the list. it returns
+        // false, and leaves the list unchanged, if the list is
+        // already full.
+        constexpr bool append(const T& val) {
+            if (this->size == N) {
+                return false;
+            }
+            this->elts[this->size++] = val;
+            return true;
+        }
+
+        /////
+        // getters
+        /////
+
+        // get returns the element at index idx, or nullopt if
+        // no such element exists. unlike LinkedList, this is an
+        // O(1) operation.
+        constexpr std::optional<T> get(size_t idx) const {
+            if (idx >= this->size) {
+                return std::nullopt;
+            }
+            return this->elts[idx];
+        }
+
+        // head returns the first element in the list if there
+        // is one, or nullopt otherwise
+        constexpr std::optional<T> head() const {
+            return this->get(0);
+        }
+
+        // len returns the current length of the list
+        constexpr size_t len() const {
+            return this->size;
+        }
+
+        // cap returns the maximum length of the list
+        static constexpr size_t cap() {
+            return N;
+        }
+
+        /////
+        // transformers
+        /////
+
+        // forEach iterates through each element in this list and
+        // calls fn(index, value) for each, sequentially and in
+        // order
+        template <typename F>
+        constexpr void forEach(F fn) const {
+            for (size_t i = 0; i < this->size; ++i) {
+                fn(i, this->elts[i]);
+            }
+        }
+
+        // find returns the first element whose value
+        // satisfies fn(index, value), or none if no
+        // such element exists.
+        template <typename F>
+        constexpr std::optional<T> find(F fn) const {
+            for (size_t i = 0; i < this->size; ++i) {
+                if (fn(i, this->elts[i])) {
+                    return this->elts[i];
+                }
+            }
+            return std::nullopt;
+        }
+
+        // map applies fn(index, value) to each element in the
+        // list and returns a new list, with the same capacity,
+        // holding the results
+        template <typename U, typename F>
+        constexpr FixedList<U, N> map(F fn) const {
+            FixedList<U, N> ret;
+            for (size_t i = 0; i < this->size; ++i) {
+                ret.append(fn(i, this->elts[i]));
+            }
+            return ret;
+        }
+
+        // reduce collapses the entire list into a single value.
+        // see reducer_fn documentation in ll_funcs.hpp for
+        // more detail.
+        template <typename U, typename F>
+        constexpr U reduce(const U& accum, F fn) const {
+            U ret = accum;
+            for (size_t i = 0; i < this->size; ++i) {
+                ret = fn(i, ret, this->elts[i]);
+            }
+            return ret;
+        }
+};
+} // linkedlist
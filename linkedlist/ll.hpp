@@ -3,6 +3,7 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <optional>
 #include <utility>
 
@@ -11,13 +12,73 @@
 
 namespace linkedlist {
 
+template <typename T>
+class Pipeline;
+
 template <typename T>
 class LinkedList {
     private:
+        // Pipeline::collect links the nodes it receives straight
+        // into its result with appendNode
+        template <typename U>
+        friend class Pipeline;
+
         Node<T> *first;
         Node<T> *last;
         size_t size;
     
+        // appendNode links node onto the end of this list.
+        // node must not belong to any list.
+        void appendNode(Node<T>* node) {
+            node->next = NULL;
+            if (this->first == NULL) {
+                this->first = node;
+            } else {
+                this->last->next = node;
+            }
+            this->last = node;
+            this->size++;
+        }
+
+        // BatchBuffer is the raw, suitably aligned storage that
+        // forEachBatch copies each batch into. it tracks how many
+        // elements are live in it, so that if copying or the
+        // caller's function throws, the elements are destroyed
+        // and the storage freed during unwinding.
+        struct BatchBuffer {
+            public:
+                T* elts;
+                size_t count;
+
+                explicit BatchBuffer(size_t capacity):
+                    elts(static_cast<T*>(::operator new(
+                        capacity * sizeof(T),
+                        std::align_val_t(alignof(T))
+                    ))),
+                    count(0) {}
+
+                BatchBuffer(const BatchBuffer& other) = delete;
+                BatchBuffer& operator=(const BatchBuffer& other) = delete;
+
+                ~BatchBuffer() {
+                    this->clear();
+                    ::operator delete(this->elts, std::align_val_t(alignof(T)));
+                }
+
+                // push copies val into the next free slot
+                void push(const T& val) {
+                    new (&this->elts[this->count]) T(val);
+                    this->count++;
+                }
+
+                // clear destroys every live element
+                void clear() {
+                    while (this->count > 0) {
+                        this->elts[--this->count].~T();
+                    }
+                }
+        };
+
     public:
         
         ///// 
@@ -109,6 +170,39 @@ class LinkedList {
             });
         }
         
+        // appendRange adds all values in [begin, end), in
+        // order, to the end of this
+        template <typename It>
+        void appendRange(It begin, It end) {
+            for (auto it = begin; it != end; ++it) {
+                this->append(*it);
+            }
+        }
+
+        // popN removes up to n elements from the front of the
+        // list and moves them, in order, into out, which must
+        // have room for n elements. returns the number of
+        // elements removed, which is less than n only if the
+        // list ran out.
+        size_t popN(T* out, size_t n) {
+            size_t popped = 0;
+            while (popped < n && this->first != NULL) {
+                // move the value out while the node is still
+                // linked, so that if the move throws the element
+                // stays in the list
+                auto curFirst = this->first;
+                out[popped] = std::move(curFirst->val);
+                this->first = curFirst->next;
+                this->size--;
+                if (this->first == NULL) {
+                    this->last = NULL;
+                }
+                delete curFirst;
+                popped++;
+            }
+            return popped;
+        }
+        
         /////
         // getters
         /////
@@ -188,6 +282,89 @@ class LinkedList {
             return ret;
         }
 
+        // partitionInto moves every node in this list into one
+        // of the numBuckets lists in buckets, choosing the bucket
+        // at index fn(index, value) % numBuckets. nodes are
+        // appended to the end of their bucket in their original
+        // order, after anything the bucket already contains.
+        //
+        // this is done in one pass by relinking the existing
+        // nodes, so no nodes are allocated and no values are
+        // copied. this list may itself be one of the buckets, in
+        // which case it ends up holding just the nodes fn put in
+        // it. otherwise, it's empty after the call. if fn throws,
+        // the nodes it hasn't placed yet are put back on the end
+        // of this list.
+        void partitionInto(LinkedList<T>* buckets, size_t numBuckets, bucket_fn<T> fn) {
+            if (numBuckets == 0) {
+                return;
+            }
+            // detach the whole chain first, so that appending to
+            // this list, if it's a bucket, doesn't feed the loop
+            auto cur = this->first;
+            auto curLast = this->last;
+            size_t remaining = this->size;
+            this->first = NULL;
+            this->last = NULL;
+            this->size = 0;
+            size_t idx = 0;
+            try {
+                while (cur != NULL) {
+                    auto& bucket = buckets[fn(idx++, cur->val) % numBuckets];
+                    auto next = cur->next;
+                    bucket.appendNode(cur);
+                    cur = next;
+                    remaining--;
+                }
+            } catch (...) {
+                if (cur != NULL) {
+                    if (this->first == NULL) {
+                        this->first = cur;
+                    } else {
+                        this->last->next = cur;
+                    }
+                    this->last = curLast;
+                    this->size += remaining;
+                }
+                throw;
+            }
+        }
+
+        // zipInPlace alternates the nodes of other into this list
+        // in the same order that zip does, but relinks the
+        // existing nodes instead of copying their values into
+        // a new list. after the call, other is empty.
+        void zipInPlace(const std::shared_ptr<LinkedList<T>> other) {
+            if (other.get() == this || other->first == NULL) {
+                return;
+            }
+            if (this->first == NULL) {
+                this->first = other->first;
+                this->last = other->last;
+            } else {
+                auto thisCur = this->first;
+                auto otherCur = other->first;
+                while ((thisCur != NULL) && (otherCur != NULL)) {
+                    auto thisNext = thisCur->next;
+                    auto otherNext = otherCur->next;
+                    thisCur->next = otherCur;
+                    if (thisNext == NULL) {
+                        // this list ran out first, so the rest
+                        // of other is already linked after otherCur
+                        this->last = other->last;
+                        break;
+                    }
+                    otherCur->next = thisNext;
+                    thisCur = thisNext;
+                    otherCur = otherNext;
+                }
+            }
+            this->size += other->size;
+            other->first = NULL;
+            other->last = NULL;
+            other->size = 0;
+        }
+
         // reverse reverses this linked list in place
         void reverse() {
             // if the list has 0 or 1 elements, do nothing
@@ -267,6 +444,38 @@ class LinkedList {
             }
         }
 
+        // forEachBatch iterates through this list in batches of
+        // up to batchSize elements and calls fn once per batch,
+        // sequentially and in order. every batch but the last
+        // has exactly batchSize elements.
+        //
+        // nodes are not contiguous in memory, so each batch is
+        // copied into a single reusable buffer before fn is
+        // called. this lets fn work on plain arrays and spreads
+        // the cost of calling it over the whole batch.
+        void forEachBatch(size_t batchSize, const for_each_batch_fn<T>& fn) const {
+            if (batchSize == 0 || this->first == NULL) {
+                return;
+            }
+            if (batchSize > this->size) {
+                batchSize = this->size;
+            }
+            // raw storage, so that T doesn't need to be
+            // default constructible
+            BatchBuffer buf(batchSize);
+            auto cur = this->first;
+            size_t idx = 0;
+            while (cur != NULL) {
+                while (buf.count < batchSize && cur != NULL) {
+                    buf.push(cur->val);
+                    cur = cur->next;
+                }
+                fn(idx, buf.elts, buf.count);
+                idx += buf.count;
+                buf.clear();
+            }
+        }
+
         // find returns the first element whose value 
         // satisfies fn(index, value), or none if no
         // such element exists.
@@ -20,6 +20,16 @@ using find_fn = std::function<bool(size_t, const T&)>;
 template <typename T>
 using for_each_fn = std::function<void(size_t, const T&)>;
 
+// for_each_batch_fn is the type of the function used
+// in LinkedList<T>::forEachBatch. The function is
+// passed the index of the first element in the batch,
+// a pointer to a contiguous buffer holding the batch's
+// elements, in order, and the number of elements in
+// the buffer. the buffer is only valid for the
+// duration of the call.
+template <typename T>
+using for_each_batch_fn = std::function<void(size_t, const T*, size_t)>;
+
 // map_fn is the type of the function used in
 // LinkedList<T>::map<U>. The function is called
 // in the same way as find_fn is, but it should
@@ -27,6 +37,14 @@ using for_each_fn = std::function<void(size_t, const T&)>;
 template <typename T, typename U>
 using map_fn = std::function<U(size_t, T)>;
 
+// bucket_fn is the type of the function used in
+// LinkedList<T>::partitionInto. The function is
+// called in the same way as find_fn, but it should
+// return the index of the bucket that the element
+// belongs in.
+template <typename T>
+using bucket_fn = std::function<size_t(size_t, const T&)>;
+
 // reduce_fn is the type of function used in 
 // LinkedList<T>::reduce<U>. The intention of
 // this function is to collapse an entire list
@@ -43,4 +61,11 @@ using map_fn = std::function<U(size_t, T)>;
 template <typename T, typename U>
 using reduce_fn = std::function<U(size_t, const U&, const T&)>;
 
+// evict_fn is the type of the function used in
+// LRUCache<K, V>. it's called once for every entry
+// the cache evicts to stay within its capacity, and
+// is passed the key and value of the evicted entry.
+template <typename K, typename V>
+using evict_fn = std::function<void(const K&, const V&)>;
+
 }// linkedlist
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "ll_funcs.hpp"
+#include "node.hpp"
+
+namespace linkedlist {
+
+// LRUCache is a fixed capacity key/value cache that evicts
+// the least recently used entry when it's full.
+//
+// entries are kept in a doubly linked recency list, ordered
+// from most recently used (first) to least recently used
+// (last), so moving an entry to the front and evicting from
+// the back are both O(1). a chained hash index sits alongside
+// the list so that finding the node for a key is O(1) on
+// average, rather than an O(N) scan of the list. the index
+// grows with the number of entries rather than being sized
+// for capacity up front, so a cache with a huge capacity
+// costs nothing until it's used.
+//
+// LRUCache is not safe for concurrent use. see ShardedLRUCache
+// for that.
+template <typename K, typename V>
+class LRUCache {
+    private:
+        LRUNode<K, V>* first;
+        LRUNode<K, V>* last;
+        LRUNode<K, V>** buckets;
+        size_t numBuckets;
+        size_t size;
+        size_t capacity;
+        evict_fn<K, V> onEvict;
+
+        // bucketFor returns the index into buckets that key
+        // falls into. numBuckets is always a power of two, so
+        // this is a mask rather than a modulo.
+        size_t bucketFor(const K& key) const {
+            return std::hash<K>{}(key) & (this->numBuckets - 1);
+        }
+
+        // lookup returns the node for key, or NULL if key is
+        // not in the cache
+        LRUNode<K, V>* lookup(const K& key) const {
+            auto cur = this->buckets[this->bucketFor(key)];
+            while (cur != NULL) {
+                if (cur->key == key) {
+                    return cur;
+                }
+                cur = cur->bucketNext;
+            }
+            return NULL;
+        }
+
+        // unlink removes node from the recency list, but
+        // leaves it in its hash bucket
+        void unlink(LRUNode<K, V>* node) {
+            if (node->prev == NULL) {
+                this->first = node->next;
+            } else {
+                node->prev->next = node->next;
+            }
+            if (node->next == NULL) {
+                this->last = node->prev;
+            } else {
+                node->next->prev = node->prev;
+            }
+            node->prev = NULL;
+            node->next = NULL;
+        }
+
+        // pushFront adds node to the front of the recency list
+        void pushFront(LRUNode<K, V>* node) {
+            node->next = this->first;
+            if (this->first == NULL) {
+                this->last = node;
+            } else {
+                this->first->prev = node;
+            }
+            this->first = node;
+        }
+
+        // index adds node to the front of its hash bucket
+        void index(LRUNode<K, V>* node) {
+            auto& bucket = this->buckets[this->bucketFor(node->key)];
+            node->bucketNext = bucket;
+            bucket = node;
+        }
+
+        // growIfNeeded doubles the number of buckets and rehashes
+        // every entry if adding one more entry would push the load
+        // factor above 1. it stops growing at the first power of
+        // two that's at least capacity, or when doubling again
+        // would overflow.
+        void growIfNeeded() {
+            const size_t maxBuckets = (~size_t(0) >> 1) + 1;
+            if (this->size < this->numBuckets
+                || this->numBuckets >= this->capacity
+                || this->numBuckets >= maxBuckets) {
+                return;
+            }
+            // allocate before touching anything, so that if it
+            // throws the cache is unchanged
+            auto grown = new LRUNode<K, V>*[this->numBuckets * 2]();
+            delete[] this->buckets;
+            this->buckets = grown;
+            this->numBuckets *= 2;
+            auto cur = this->first;
+            while (cur != NULL) {
+                this->index(cur);
+                cur = cur->next;
+            }
+        }
+
+        // unindex removes node from its hash bucket. the load
+        // factor never exceeds 1 until the index stops growing,
+        // so chains are short.
+        void unindex(LRUNode<K, V>* node) {
+            auto slot = &this->buckets[this->bucketFor(node->key)];
+            while (*slot != node) {
+                slot = &(*slot)->bucketNext;
+            }
+            *slot = node->bucketNext;
+        }
+
+        // evictLast removes the least recently used entry
+        // and passes it to onEvict, if set. the node is freed
+        // even if onEvict throws.
+        void evictLast() {
+            std::unique_ptr<LRUNode<K, V>> node(this->last);
+            this->unlink(node.get());
+            this->unindex(node.get());
+            this->size--;
+            if (this->onEvict) {
+                this->onEvict(node->key, node->val);
+            }
+        }
+
+    public:
+
+        /////
+        // constructors and destructor
+        /////
+
+        // creates a new cache that holds at most capacity
+        // entries. onEvict, if given, is called for every
+        // entry evicted to make room for a new one. a cache
+        // with a capacity of 0 stores nothing.
+        explicit LRUCache(size_t capacity, evict_fn<K, V> onEvict = nullptr):
+            first(NULL),
+            last(NULL),
+            buckets(NULL),
+            numBuckets(1),
+            size(0),
+            capacity(capacity),
+            onEvict(onEvict) {
+            // start small, and let growIfNeeded take it from here
+            while (this->numBuckets < capacity && this->numBuckets < 16) {
+                this->numBuckets <<= 1;
+            }
+            this->buckets = new LRUNode<K, V>*[this->numBuckets]();
+        }
+
+        LRUCache(const LRUCache<K, V>& other) = delete;
+        LRUCache<K, V>& operator=(const LRUCache<K, V>& other) = delete;
+
+        ~LRUCache() {
+            auto cur = this->first;
+            while (cur != NULL) {
+                auto next = cur->next;
+                delete cur;
+                cur = next;
+            }
+            delete[] this->buckets;
+        }
+
+        /////
+        // modifiers
+        /////
+
+        // put inserts val under key and marks it as the most
+        // recently used entry. if key is already present, its
+        // value is replaced. if the cache is full, the least
+        // recently used entry is evicted first.
+        void put(const K& key, const V& val) {
+            if (this->capacity == 0) {
+                return;
+            }
+            auto node = this->lookup(key);
+            if (node != NULL) {
+                node->val = val;
+                this->unlink(node);
+                this->pushFront(node);
+                return;
+            }
+            if (this->size == this->capacity) {
+                this->evictLast();
+            }
+            this->growIfNeeded();
+            node = new LRUNode<K, V>(key, val);
+            this->index(node);
+            this->pushFront(node);
+            this->size++;
+        }
+
+        // remove removes key from the cache and returns its
+        // value, or nullopt if key was not present. removed
+        // entries are not passed to onEvict.
+        std::optional<V> remove(const K& key) {
+            auto node = this->lookup(key);
+            if (node == NULL) {
+                return std::nullopt;
+            }
+            this->unlink(node);
+            this->unindex(node);
+            this->size--;
+            auto ret = node->val;
+            delete node;
+            return ret;
+        }
+
+        /////
+        // getters
+        /////
+
+        // get returns the value for key and marks it as the
+        // most recently used entry, or returns nullopt if key
+        // is not in the cache
+        std::optional<V> get(const K& key) {
+            auto node = this->lookup(key);
+            if (node == NULL) {
+                return std::nullopt;
+            }
+            if (node != this->first) {
+                this->unlink(node);
+                this->pushFront(node);
+            }
+            return node->val;
+        }
+
+        // peek is like get, but does not change the recency
+        // of key
+        std::optional<V> peek(const K& key) const {
+            auto node = this->lookup(key);
+            if (node == NULL) {
+                return std::nullopt;
+            }
+            return node->val;
+        }
+
+        // len returns the number of entries in the cache
+        size_t len() const {
+            return this->size;
+        }
+
+        // cap returns the maximum number of entries the
+        // cache will hold
+        size_t cap() const {
+            return this->capacity;
+        }
+};
+
+// ShardedLRUCache is a thread safe LRUCache. keys are spread
+// over a fixed number of independent shards, each of which
+// is an LRUCache guarded by its own mutex, so threads that
+// touch different shards don't contend with each other.
+//
+// recency is tracked per shard, so the entry evicted is the
+// least recently used one in its shard, which is not
+// necessarily the least recently used one overall.
+template <typename K, typename V>
+class ShardedLRUCache {
+    private:
+        size_t numShards;
+        std::mutex* locks;
+        LRUCache<K, V>** shards;
+
+        // shardFor returns the index of the shard that key
+        // belongs to. the hash is mixed first so that the
+        // shard doesn't depend on the same low bits that
+        // LRUCache uses to pick a bucket.
+        size_t shardFor(const K& key) const {
+            const unsigned long long mixed =
+                std::hash<K>{}(key) * 0x9E3779B97F4A7C15ULL;
+            return (mixed >> 32) % this->numShards;
+        }
+
+    public:
+
+        /////
+        // constructors and destructor
+        /////
+
+        // creates a new cache with numShards shards that holds
+        // roughly capacity entries in total. capacity is split
+        // evenly between shards, rounding up. onEvict, if given,
+        // is called while the evicting shard's lock is held, so
+        // it must not call back into this cache.
+        ShardedLRUCache(size_t numShards, size_t capacity, evict_fn<K, V> onEvict = nullptr):
+            numShards(numShards == 0 ? 1 : numShards),
+            locks(NULL),
+            shards(NULL) {
+            // rounds up without overflowing for huge capacities
+            const size_t shardCap = capacity / this->numShards
+                + (capacity % this->numShards == 0 ? 0 : 1);
+            this->locks = new std::mutex[this->numShards];
+            this->shards = new LRUCache<K, V>*[this->numShards];
+            for (size_t i = 0; i < this->numShards; ++i) {
+                this->shards[i] = new LRUCache<K, V>(shardCap, onEvict);
+            }
+        }
+
+        ShardedLRUCache(const ShardedLRUCache<K, V>& other) = delete;
+        ShardedLRUCache<K, V>& operator=(const ShardedLRUCache<K, V>& other) = delete;
+
+        ~ShardedLRUCache() {
+            for (size_t i = 0; i < this->numShards; ++i) {
+                delete this->shards[i];
+            }
+            delete[] this->shards;
+            delete[] this->locks;
+        }
+
+        /////
+        // modifiers
+        /////
+
+        // put behaves like LRUCache<K, V>::put
+        void put(const K& key, const V& val) {
+            const size_t idx = this->shardFor(key);
+            std::lock_guard<std::mutex> guard(this->locks[idx]);
+            this->shards[idx]->put(key, val);
+        }
+
+        // remove behaves like LRUCache<K, V>::remove
+        std::optional<V> remove(const K& key) {
+            const size_t idx = this->shardFor(key);
+            std::lock_guard<std::mutex> guard(this->locks[idx]);
+            return this->shards[idx]->remove(key);
+        }
+
+        /////
+        // getters
+        /////
+
+        // get behaves like LRUCache<K, V>::get
+        std::optional<V> get(const K& key) {
+            const size_t idx = this->shardFor(key);
+            std::lock_guard<std::mutex> guard(this->locks[idx]);
+            return this->shards[idx]->get(key);
+        }
+
+        // peek behaves like LRUCache<K, V>::peek
+        std::optional<V> peek(const K& key) const {
+            const size_t idx = this->shardFor(key);
+            std::lock_guard<std::mutex> guard(this->locks[idx]);
+            return this->shards[idx]->peek(key);
+        }
+
+        // len returns the total number of entries across all
+        // shards. shards are locked one at a time, so the
+        // result may be stale if other threads are writing.
+        size_t len() const {
+            size_t ret = 0;
+            for (size_t i = 0; i < this->numShards; ++i) {
+                std::lock_guard<std::mutex> guard(this->locks[i]);
+                ret += this->shards[i]->len();
+            }
+            return ret;
+        }
+
+        // cap returns the maximum number of entries the
+        // cache will hold across all shards
+        size_t cap() const {
+            const size_t shardCap = this->shards[0]->cap();
+            if (shardCap > ~size_t(0) / this->numShards) {
+                return ~size_t(0);
+            }
+            return shardCap * this->numShards;
+        }
+};
+} // linkedlist
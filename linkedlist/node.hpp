@@ -11,4 +11,35 @@ struct Node {
         
         explicit Node(const T& val): val(val), next(NULL) {}
 };
+
+// SortedNode is a single element of a SortedLinkedList.
+// it's doubly linked so that the list can search backward
+// from a node as well as forward.
+template <typename T>
+struct SortedNode {
+    public:
+        SortedNode<T>* prev;
+        SortedNode<T>* next;
+        T val;
+
+        explicit SortedNode(const T& val): prev(NULL), next(NULL), val(val) {}
+};
+
+// LRUNode is a single entry in an LRUCache. each node
+// is linked into two lists at the same time: the doubly
+// linked recency list (prev and next), and the singly
+// linked chain of the hash bucket its key falls into
+// (bucketNext).
+template <typename K, typename V>
+struct LRUNode {
+    public:
+        LRUNode<K, V>* prev;
+        LRUNode<K, V>* next;
+        LRUNode<K, V>* bucketNext;
+        K key;
+        V val;
+
+        LRUNode(const K& key, const V& val):
+            prev(NULL), next(NULL), bucketNext(NULL), key(key), val(val) {}
+};
 } // linkedlist
@@ -0,0 +1,495 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "ll.hpp"
+#include "ll_funcs.hpp"
+#include "node.hpp"
+
+namespace linkedlist {
+
+// NodeChain is a run of linked nodes that pipeline stages
+// hand to each other as a unit. it owns its nodes until
+// they're moved somewhere else.
+template <typename T>
+struct NodeChain {
+    public:
+        Node<T>* first;
+        Node<T>* last;
+        size_t size;
+
+        NodeChain(): first(NULL), last(NULL), size(0) {}
+
+        // append links node onto the end of the chain
+        void append(Node<T>* node) {
+            node->next = NULL;
+            if (this->first == NULL) {
+                this->first = node;
+            } else {
+                this->last->next = node;
+            }
+            this->last = node;
+            this->size++;
+        }
+
+        // pop unlinks and returns the first node in the
+        // chain, or NULL if the chain is empty
+        Node<T>* pop() {
+            auto node = this->first;
+            if (node == NULL) {
+                return NULL;
+            }
+            this->first = node->next;
+            if (this->first == NULL) {
+                this->last = NULL;
+            }
+            this->size--;
+            return node;
+        }
+
+        // clear deletes every node in the chain
+        void clear() {
+            while (this->first != NULL) {
+                delete this->pop();
+            }
+        }
+};
+
+// BoundedQueue passes nodes from one pipeline stage to the
+// next. it holds at most capacity nodes, and producers block
+// until there is room, so a fast stage can't run arbitrarily
+// far ahead of a slow one.
+//
+// nodes are moved through the queue by relinking them, so
+// passing values between stages doesn't copy or allocate.
+template <typename T>
+class BoundedQueue {
+    private:
+        NodeChain<T> nodes;
+        size_t capacity;
+        bool closed;
+        bool cancelled;
+        std::mutex mu;
+        std::condition_variable notFull;
+        std::condition_variable notEmpty;
+
+    public:
+        explicit BoundedQueue(size_t capacity):
+            capacity(capacity == 0 ? 1 : capacity),
+            closed(false),
+            cancelled(false) {}
+
+        BoundedQueue(const BoundedQueue<T>& other) = delete;
+        BoundedQueue<T>& operator=(const BoundedQueue<T>& other) = delete;
+
+        ~BoundedQueue() {
+            this->nodes.clear();
+        }
+
+        // push moves every node in chain onto the end of the
+        // queue, blocking until there is room for all of them.
+        // chain is empty when push returns. if the queue has
+        // been cancelled, the nodes are deleted instead and
+        // push returns false.
+        bool push(NodeChain<T>& chain) {
+            if (chain.size == 0) {
+                return true;
+            }
+            std::unique_lock<std::mutex> lock(this->mu);
+            this->notFull.wait(lock, [this, &chain]() {
+                return this->cancelled
+                    || this->nodes.size == 0
+                    || this->nodes.size + chain.size <= this->capacity;
+            });
+            if (this->cancelled) {
+                lock.unlock();
+                chain.clear();
+                return false;
+            }
+            if (this->nodes.first == NULL) {
+                this->nodes.first = chain.first;
+            } else {
+                this->nodes.last->next = chain.first;
+            }
+            this->nodes.last = chain.last;
+            this->nodes.size += chain.size;
+            chain = NodeChain<T>();
+            lock.unlock();
+            this->notEmpty.notify_one();
+            return true;
+        }
+
+        // pop removes and returns every node currently in the
+        // queue, blocking while it's empty. it returns an empty
+        // chain once the queue is closed and drained, or as soon
+        // as it's cancelled.
+        NodeChain<T> pop() {
+            std::unique_lock<std::mutex> lock(this->mu);
+            this->notEmpty.wait(lock, [this]() {
+                return this->cancelled || this->closed || this->nodes.size > 0;
+            });
+            if (this->cancelled) {
+                return NodeChain<T>();
+            }
+            auto ret = this->nodes;
+            this->nodes = NodeChain<T>();
+            lock.unlock();
+            this->notFull.notify_one();
+            return ret;
+        }
+
+        // close signals that no more nodes will be pushed.
+        // consumers drain what's left, then pop returns an
+        // empty chain.
+        void close() {
+            {
+                std::lock_guard<std::mutex> guard(this->mu);
+                this->closed = true;
+            }
+            this->notEmpty.notify_all();
+        }
+
+        // cancel wakes up every blocked producer and consumer
+        // and makes all later pushes and pops fail immediately
+        void cancel() {
+            {
+                std::lock_guard<std::mutex> guard(this->mu);
+                this->cancelled = true;
+            }
+            this->notFull.notify_all();
+            this->notEmpty.notify_all();
+        }
+};
+
+// PipelineFailure records the first exception thrown by any
+// stage of a pipeline, so that it can be rethrown on the thread
+// that runs the pipeline's terminal operation.
+class PipelineFailure {
+    private:
+        std::mutex mu;
+        std::exception_ptr err;
+
+    public:
+        // record stores err, unless an earlier exception has
+        // already been stored
+        void record(std::exception_ptr err) {
+            std::lock_guard<std::mutex> guard(this->mu);
+            if (!this->err) {
+                this->err = err;
+            }
+        }
+
+        // rethrow rethrows the stored exception, if there is one
+        void rethrow() {
+            std::lock_guard<std::mutex> guard(this->mu);
+            if (this->err) {
+                std::rethrow_exception(this->err);
+            }
+        }
+};
+
+// PipelineStage owns the thread that runs a single stage of a
+// Pipeline. stages are linked to the stage before them, so the
+// stages of a pipeline form a list that ends at the source.
+//
+// destroying a stage cancels its queues and joins its thread,
+// then releases the stage before it, so dropping a pipeline
+// part way through shuts every stage down rather than leaving
+// threads blocked on a full queue.
+class PipelineStage {
+    private:
+        std::shared_ptr<PipelineStage> upstream;
+        std::function<void()> cancel;
+        std::thread worker;
+
+    public:
+        PipelineStage(
+            std::shared_ptr<PipelineStage> upstream,
+            std::function<void()> cancel,
+            std::function<void()> run
+        ): upstream(upstream), cancel(cancel), worker(run) {}
+
+        PipelineStage(const PipelineStage& other) = delete;
+        PipelineStage& operator=(const PipelineStage& other) = delete;
+
+        ~PipelineStage() {
+            this->cancel();
+            this->worker.join();
+        }
+};
+
+// Pipeline runs a chain of map, filter and flatMap stages over a
+// LinkedList concurrently. every stage runs on its own thread and
+// hands its results to the next stage through a BoundedQueue that
+// holds at most depth nodes, so stages overlap with each other
+// instead of each waiting for the previous one to finish the whole
+// list, and the number of in-flight values is bounded by the queue
+// depth rather than by the size of the list. each stage holds at
+// most about 2.5 times depth values at once: up to depth in its
+// input queue, up to depth more that it has popped from that queue
+// and is working through, and a batch of up to depth / 2 it's
+// collecting for the next stage.
+//
+// for example, this is the pipelined version of
+// ll->map<int>(f)->filter(g)->reduce<int>(0, h):
+//
+//     Pipeline<int>::from(ll, 256).map<int>(f).filter(g).reduce<int>(0, h)
+//
+// each stage is started as soon as it's added, and the results
+// are collected by calling reduce or collect on the last one.
+// indices passed to stage functions are the same as the sequential
+// chain would pass, i.e. the index of the value in that stage's
+// input.
+//
+// a pipeline is single use, so adding a stage or running a terminal
+// operation consumes it. those members only work on rvalues, which
+// makes it a compile error to reuse a pipeline by accident.
+//
+// if a stage function throws, every stage is cancelled, and the
+// first exception thrown is rethrown from reduce or collect. stage
+// functions run on other threads, and must not modify the source
+// list while the pipeline is running.
+template <typename T>
+class Pipeline {
+    private:
+        template <typename U>
+        friend class Pipeline;
+
+        template <typename U>
+        using emit_fn = std::function<void(Node<U>*)>;
+
+        template <typename U>
+        using step_fn = std::function<void(size_t, Node<T>*, const emit_fn<U>&)>;
+
+        std::shared_ptr<BoundedQueue<T>> queue;
+        std::shared_ptr<PipelineStage> stage;
+        std::shared_ptr<PipelineFailure> failure;
+        size_t depth;
+
+        Pipeline(
+            std::shared_ptr<BoundedQueue<T>> queue,
+            std::shared_ptr<PipelineStage> stage,
+            std::shared_ptr<PipelineFailure> failure,
+            size_t depth
+        ): queue(queue), stage(stage), failure(failure), depth(depth) {}
+
+        // batchSize returns the number of nodes a stage collects
+        // before pushing them downstream. pushing in batches keeps
+        // the queue's lock off the per-value path, and using half
+        // the queue depth lets the producer fill one half while
+        // the consumer drains the other.
+        static size_t batchSize(size_t depth) {
+            return depth < 2 ? 1 : depth / 2;
+        }
+
+        // addStage starts a new stage that pops nodes from this
+        // pipeline's queue and calls step for each one. step owns
+        // the node it's given, and passes any nodes it wants to
+        // send downstream to its emit argument.
+        //
+        // if step throws, the exception is recorded and the
+        // stage's output is cancelled, which stops the stages
+        // after it. if the output is cancelled, the stage cancels
+        // its input too, which stops the stages before it.
+        template <typename U>
+        Pipeline<U> addStage(step_fn<U> step) {
+            auto in = this->queue;
+            auto out = std::make_shared<BoundedQueue<U>>(this->depth);
+            auto failure = this->failure;
+            const size_t batch = batchSize(this->depth);
+            auto cancel = [in, out]() {
+                in->cancel();
+                out->cancel();
+            };
+            auto run = [in, out, failure, step, batch]() {
+                NodeChain<T> chain;
+                NodeChain<U> pending;
+                bool ok = true;
+                try {
+                    // built once, rather than once per value
+                    const emit_fn<U> emit = [out, batch, &pending, &ok](Node<U>* node) {
+                        if (!ok) {
+                            delete node;
+                            return;
+                        }
+                        pending.append(node);
+                        if (pending.size >= batch) {
+                            ok = out->push(pending);
+                        }
+                    };
+                    size_t idx = 0;
+                    chain = in->pop();
+                    while (ok && chain.first != NULL) {
+                        auto node = chain.pop();
+                        while (node != NULL) {
+                            step(idx++, node, emit);
+                            node = chain.pop();
+                        }
+                        chain = in->pop();
+                    }
+                    if (ok) {
+                        ok = out->push(pending);
+                    }
+                } catch (...) {
+                    failure->record(std::current_exception());
+                    ok = false;
+                    out->cancel();
+                }
+                if (!ok) {
+                    in->cancel();
+                }
+                chain.clear();
+                pending.clear();
+                out->close();
+            };
+            auto next = std::make_shared<PipelineStage>(this->stage, cancel, run);
+            return Pipeline<U>(out, next, failure, this->depth);
+        }
+
+        // drain pops every node that reaches the end of the
+        // pipeline and passes it, along with its index, to take,
+        // which owns it from then on. once the pipeline is done,
+        // drain rethrows the first exception any stage threw.
+        void drain(const std::function<void(size_t, Node<T>*)>& take) {
+            size_t idx = 0;
+            auto chain = this->queue->pop();
+            try {
+                while (chain.first != NULL) {
+                    auto node = chain.pop();
+                    while (node != NULL) {
+                        take(idx++, node);
+                        node = chain.pop();
+                    }
+                    chain = this->queue->pop();
+                }
+            } catch (...) {
+                chain.clear();
+                throw;
+            }
+            this->failure->rethrow();
+        }
+
+    public:
+
+        /////
+        // sources
+        /////
+
+        // from starts a pipeline that reads every value in src,
+        // in order. depth is the maximum number of values each
+        // queue between stages will hold.
+        static Pipeline<T> from(const std::shared_ptr<LinkedList<T>> src, size_t depth) {
+            if (depth == 0) {
+                depth = 1;
+            }
+            auto out = std::make_shared<BoundedQueue<T>>(depth);
+            auto failure = std::make_shared<PipelineFailure>();
+            const size_t batch = batchSize(depth);
+            auto cancel = [out]() {
+                out->cancel();
+            };
+            auto run = [src, out, failure, batch]() {
+                NodeChain<T> pending;
+                bool ok = true;
+                try {
+                    // find stops as soon as fn returns true, which
+                    // lets the source stop early if it's cancelled
+                    src->find([out, batch, &pending, &ok](size_t idx, const T& val) {
+                        pending.append(new Node<T>(val));
+                        if (pending.size >= batch) {
+                            ok = out->push(pending);
+                        }
+                        return !ok;
+                    });
+                    if (ok) {
+                        out->push(pending);
+                    }
+                } catch (...) {
+                    failure->record(std::current_exception());
+                    out->cancel();
+                }
+                pending.clear();
+                out->close();
+            };
+            auto stage = std::make_shared<PipelineStage>(nullptr, cancel, run);
+            return Pipeline<T>(out, stage, failure, depth);
+        }
+
+        /////
+        // stages
+        /////
+
+        // map adds a stage that behaves like LinkedList<T>::map
+        template <typename U>
+        Pipeline<U> map(map_fn<T, U> fn) && {
+            return this->addStage<U>([fn](size_t idx, Node<T>* node, const emit_fn<U>& emit) {
+                std::unique_ptr<Node<T>> owned(node);
+                emit(new Node<U>(fn(idx, owned->val)));
+            });
+        }
+
+        // filter adds a stage that behaves like
+        // LinkedList<T>::filter. values that pass are sent
+        // downstream in the node they arrived in.
+        Pipeline<T> filter(find_fn<T> fn) && {
+            return this->addStage<T>([fn](size_t idx, Node<T>* node, const emit_fn<T>& emit) {
+                std::unique_ptr<Node<T>> owned(node);
+                if (fn(idx, owned->val)) {
+                    emit(owned.release());
+                }
+            });
+        }
+
+        // flatMap adds a stage that behaves like
+        // LinkedList<T>::flatMap
+        template <typename U>
+        Pipeline<U> flatMap(typename LinkedList<T>::template flat_map_fn<U> fn) && {
+            return this->addStage<U>([fn](size_t idx, Node<T>* node, const emit_fn<U>& emit) {
+                std::unique_ptr<Node<T>> owned(node);
+                auto vals = fn(idx, owned->val);
+                owned.reset();
+                vals->forEach([&emit](size_t i, const U& val) {
+                    emit(new Node<U>(val));
+                });
+            });
+        }
+
+        /////
+        // terminal operations
+        /////
+
+        // reduce runs the pipeline to completion on the calling
+        // thread and behaves like LinkedList<T>::reduce on its
+        // output. if any stage threw, reduce rethrows the first
+        // exception instead of returning.
+        template <typename U>
+        U reduce(const U& accum, reduce_fn<T, U> fn) && {
+            U ret = accum;
+            this->drain([&ret, &fn](size_t idx, Node<T>* node) {
+                std::unique_ptr<Node<T>> owned(node);
+                ret = fn(idx, ret, owned->val);
+            });
+            return ret;
+        }
+
+        // collect runs the pipeline to completion on the calling
+        // thread and returns its output as a new list. the nodes
+        // that reach the end of the pipeline are linked into the
+        // new list as they are, without being copied. like reduce,
+        // it rethrows the first exception any stage threw.
+        std::shared_ptr<LinkedList<T>> collect() && {
+            auto ret = std::make_shared<LinkedList<T>>();
+            this->drain([&ret](size_t idx, Node<T>* node) {
+                ret->appendNode(node);
+            });
+            return ret;
+        }
+
+};
+} // linkedlist
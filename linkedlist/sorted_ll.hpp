@@ -0,0 +1,429 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "ll_funcs.hpp"
+#include "node.hpp"
+
+namespace linkedlist {
+
+// SortedLinkedList is a doubly linked list that keeps its
+// elements in ascending order according to Cmp. equal elements
+// are kept in the order they were inserted.
+//
+// because both lists in a set operation are already sorted,
+// unionWith, intersect and difference are single merge passes
+// that run in O(N + M) time, and they relink or delete existing
+// nodes rather than allocating new ones.
+//
+// elements are considered equal if neither compares less than
+// the other. set operations match equal elements one to one,
+// the same way std::set_union and friends do, so a list with
+// no duplicates stays that way.
+template <typename T, typename Cmp = std::less<T>>
+class SortedLinkedList {
+    private:
+        SortedNode<T>* first;
+        SortedNode<T>* last;
+        // finger is the most recently inserted node, or NULL.
+        // insert searches outward from here, so inserting in
+        // nearly sorted order stays cheap.
+        SortedNode<T>* finger;
+        size_t size;
+        Cmp cmp;
+
+        bool equal(const T& a, const T& b) const {
+            return !this->cmp(a, b) && !this->cmp(b, a);
+        }
+
+        // advance returns the node n places after node, or
+        // NULL if the list ends first
+        static SortedNode<T>* advance(SortedNode<T>* node, size_t n) {
+            while (n > 0 && node != NULL) {
+                node = node->next;
+                --n;
+            }
+            return node;
+        }
+
+        // retreat returns the node n places before node, or
+        // NULL if the list starts first
+        static SortedNode<T>* retreat(SortedNode<T>* node, size_t n) {
+            while (n > 0 && node != NULL) {
+                node = node->prev;
+                --n;
+            }
+            return node;
+        }
+
+        // insertionPoint returns the last node whose value is
+        // not greater than val, searching outward from finger.
+        // first's value must not be greater than val, and
+        // last's value must be greater than val.
+        //
+        // it gallops: it probes 1, 2, 4, ... nodes away from
+        // finger until it passes val, then halves the step back
+        // down to 1. this follows O(d) links for a distance of
+        // d, but only makes O(log d) comparisons, and d is small
+        // when elements arrive in nearly sorted order.
+        SortedNode<T>* insertionPoint(const T& val) const {
+            auto cur = this->finger;
+            if (cur == NULL) {
+                cur = this->first;
+            }
+            size_t step = 1;
+            if (this->cmp(val, cur->val)) {
+                // val belongs before finger, so gallop backward
+                // to a node that's not greater than val
+                while (true) {
+                    auto probe = retreat(cur, step);
+                    if (probe == NULL) {
+                        cur = this->first;
+                        break;
+                    }
+                    if (!this->cmp(val, probe->val)) {
+                        cur = probe;
+                        break;
+                    }
+                    cur = probe;
+                    step *= 2;
+                }
+                step = 1;
+            }
+            // cur is not greater than val, so gallop forward
+            // to the last node that's not greater than val
+            while (true) {
+                auto probe = advance(cur, step);
+                if (probe == NULL || this->cmp(val, probe->val)) {
+                    break;
+                }
+                cur = probe;
+                step *= 2;
+            }
+            while (step > 1) {
+                step /= 2;
+                auto probe = advance(cur, step);
+                if (probe != NULL && !this->cmp(val, probe->val)) {
+                    cur = probe;
+                }
+            }
+            return cur;
+        }
+
+    public:
+
+        /////
+        // constructors and destructor
+        /////
+        explicit SortedLinkedList(Cmp cmp = Cmp()):
+            first(NULL), last(NULL), finger(NULL), size(0), cmp(cmp) {}
+
+        explicit SortedLinkedList(const SortedLinkedList<T, Cmp>& other):
+            first(NULL), last(NULL), finger(NULL), size(0), cmp(other.cmp) {
+            // other is already sorted, so every insert lands
+            // at the end
+            other.forEach([this](size_t idx, const T& val) {
+                this->insert(val);
+            });
+        }
+
+        SortedLinkedList<T, Cmp>& operator=(const SortedLinkedList<T, Cmp>& other) = delete;
+
+        ~SortedLinkedList() {
+            auto cur = this->first;
+            while (cur != NULL) {
+                auto next = cur->next;
+                delete cur;
+                cur = next;
+            }
+        }
+
+        /////
+        // modifiers
+        /////
+
+        // insert adds val to the list, after any elements equal
+        // to it. inserting at either end is O(1), and inserting
+        // near the previously inserted element is cheap on
+        // either side of it, so nearly sorted input doesn't cost
+        // O(N) per insert.
+        void insert(const T& val) {
+            auto node = new SortedNode<T>(val);
+            this->size++;
+            if (this->first == NULL) {
+                this->first = node;
+                this->last = node;
+            } else if (!this->cmp(val, this->last->val)) {
+                node->prev = this->last;
+                this->last->next = node;
+                this->last = node;
+            } else if (this->cmp(val, this->first->val)) {
+                node->next = this->first;
+                this->first->prev = node;
+                this->first = node;
+            } else {
+                auto prev = this->insertionPoint(val);
+                node->prev = prev;
+                node->next = prev->next;
+                prev->next->prev = node;
+                prev->next = node;
+            }
+            this->finger = node;
+        }
+
+        // pop removes the first (smallest) element of the
+        // list, or returns nullopt if the list is empty
+        std::optional<T> pop() {
+            if (this->first == NULL) {
+                return std::nullopt;
+            }
+            auto curFirst = this->first;
+            this->first = curFirst->next;
+            if (this->first == NULL) {
+                this->last = NULL;
+            } else {
+                this->first->prev = NULL;
+            }
+            if (this->finger == curFirst) {
+                this->finger = NULL;
+            }
+            this->size--;
+            auto ret = curFirst->val;
+            delete curFirst;
+            return ret;
+        }
+
+        // dedup removes every element that's equal to the one
+        // before it, so that each value appears once
+        void dedup() {
+            if (this->first == NULL) {
+                return;
+            }
+            this->finger = NULL;
+            auto cur = this->first;
+            while (cur->next != NULL) {
+                auto next = cur->next;
+                if (this->equal(cur->val, next->val)) {
+                    cur->next = next->next;
+                    if (cur->next != NULL) {
+                        cur->next->prev = cur;
+                    }
+                    delete next;
+                    this->size--;
+                } else {
+                    cur = next;
+                }
+            }
+            this->last = cur;
+        }
+
+        /////
+        // set operations
+        /////
+
+        // unionWith merges every element of other into this, in
+        // one pass. elements of other that are matched by an
+        // equal element in this are deleted, and the rest are
+        // relinked into this without being copied. after the
+        // call, other is empty.
+        void unionWith(const std::shared_ptr<SortedLinkedList<T, Cmp>> other) {
+            if (other.get() == this) {
+                return;
+            }
+            this->finger = NULL;
+            SortedNode<T>* head = NULL;
+            SortedNode<T>** tail = &head;
+            SortedNode<T>* lastKept = NULL;
+            auto a = this->first;
+            auto b = other->first;
+            size_t dropped = 0;
+            while (a != NULL && b != NULL) {
+                if (this->cmp(b->val, a->val)) {
+                    *tail = b;
+                    b->prev = lastKept;
+                    lastKept = b;
+                    b = b->next;
+                } else {
+                    if (!this->cmp(a->val, b->val)) {
+                        // a and b are equal, so keep a and
+                        // drop b
+                        auto next = b->next;
+                        delete b;
+                        b = next;
+                        dropped++;
+                    }
+                    *tail = a;
+                    a->prev = lastKept;
+                    lastKept = a;
+                    a = a->next;
+                }
+                tail = &lastKept->next;
+            }
+            if (a != NULL) {
+                *tail = a;
+                a->prev = lastKept;
+                lastKept = this->last;
+            } else if (b != NULL) {
+                *tail = b;
+                b->prev = lastKept;
+                lastKept = other->last;
+            } else {
+                *tail = NULL;
+            }
+            this->first = head;
+            this->last = lastKept;
+            this->size = this->size + other->size - dropped;
+            other->first = NULL;
+            other->last = NULL;
+            other->finger = NULL;
+            other->size = 0;
+        }
+
+        // intersect removes every element of this that isn't
+        // matched by an equal element in other, in one pass.
+        // other is not changed.
+        void intersect(const std::shared_ptr<SortedLinkedList<T, Cmp>> other) {
+            if (other.get() == this) {
+                return;
+            }
+            this->finger = NULL;
+            SortedNode<T>* head = NULL;
+            SortedNode<T>** tail = &head;
+            SortedNode<T>* lastKept = NULL;
+            auto a = this->first;
+            auto b = other->first;
+            while (a != NULL) {
+                auto next = a->next;
+                while (b != NULL && this->cmp(b->val, a->val)) {
+                    b = b->next;
+                }
+                if (b != NULL && !this->cmp(a->val, b->val)) {
+                    *tail = a;
+                    tail = &a->next;
+                    a->prev = lastKept;
+                    lastKept = a;
+                    b = b->next;
+                } else {
+                    delete a;
+                    this->size--;
+                }
+                a = next;
+            }
+            *tail = NULL;
+            this->first = head;
+            this->last = lastKept;
+        }
+
+        // difference removes every element of this that's
+        // matched by an equal element in other, in one pass.
+        // other is not changed.
+        void difference(const std::shared_ptr<SortedLinkedList<T, Cmp>> other) {
+            this->finger = NULL;
+            if (other.get() == this) {
+                while (this->first != NULL) {
+                    this->pop();
+                }
+                return;
+            }
+            SortedNode<T>* head = NULL;
+            SortedNode<T>** tail = &head;
+            SortedNode<T>* lastKept = NULL;
+            auto a = this->first;
+            auto b = other->first;
+            while (a != NULL) {
+                auto next = a->next;
+                while (b != NULL && this->cmp(b->val, a->val)) {
+                    b = b->next;
+                }
+                if (b != NULL && !this->cmp(a->val, b->val)) {
+                    delete a;
+                    this->size--;
+                    b = b->next;
+                } else {
+                    *tail = a;
+                    tail = &a->next;
+                    a->prev = lastKept;
+                    lastKept = a;
+                }
+                a = next;
+            }
+            *tail = NULL;
+            this->first = head;
+            this->last = lastKept;
+        }
+
+        /////
+        // getters
+        /////
+
+        // len returns the current length of the list
+        size_t len() const {
+            return this->size;
+        }
+
+        // head returns the first (smallest) element in the
+        // list if there is one, or nullopt otherwise
+        std::optional<T> head() const {
+            if (this->first == NULL) {
+                return std::nullopt;
+            }
+            return this->first->val;
+        }
+
+        // contains returns true if an element equal to val
+        // is in the list. it stops as soon as it passes where
+        // val would be.
+        bool contains(const T& val) const {
+            auto cur = this->first;
+            while (cur != NULL && this->cmp(cur->val, val)) {
+                cur = cur->next;
+            }
+            return cur != NULL && !this->cmp(val, cur->val);
+        }
+
+        /////
+        // transformers
+        /////
+
+        // forEach iterates through each element in this list, in
+        // sorted order, and calls fn for each
+        void forEach(const for_each_fn<T>& fn) const {
+            auto cur = this->first;
+            size_t i = 0;
+            while (cur != NULL) {
+                fn(i++, cur->val);
+                cur = cur->next;
+            }
+        }
+
+        // find returns the first element whose value
+        // satisfies fn(index, value), or none if no
+        // such element exists.
+        std::optional<T> find(find_fn<T> fn) const {
+            auto cur = this->first;
+            size_t idx = 0;
+            while (cur != NULL) {
+                if (fn(idx, cur->val)) {
+                    return std::make_optional(cur->val);
+                }
+                cur = cur->next;
+                ++idx;
+            }
+            return std::nullopt;
+        }
+
+        // reduce collapses the entire list into a single value.
+        // see reducer_fn documentation in ll_funcs.hpp for
+        // more detail.
+        template <typename U>
+        U reduce(const U& accum, reduce_fn<T, U> fn) const {
+            U ret = accum;
+            this->forEach([&ret, fn](size_t idx, const T& val) {
+                ret = fn(idx, ret, val);
+            });
+            return ret;
+        }
+};
+} // linkedlist
@@ -0,0 +1,78 @@
+#include <boost/test/unit_test.hpp>
+
+#include "fixed_list.hpp"
+
+using namespace linkedlist;
+
+// most of these checks are static_asserts, so if FixedList
+// stops being usable at compile time, this file stops
+// compiling.
+
+// create_fixed creates a new fixed list with num_elts
+// elements in it. the value of each element will correspond
+// to its index in the list.
+template <size_t N>
+constexpr FixedList<int, N> create_fixed(size_t num_elts) {
+    FixedList<int, N> ret;
+    for (size_t i = 0; i < num_elts; ++i) {
+        ret.append(int(i));
+    }
+    return ret;
+}
+
+constexpr auto empty_fixed = FixedList<int, 4>();
+static_assert(empty_fixed.len() == 0);
+static_assert(empty_fixed.cap() == 4);
+static_assert(!empty_fixed.head().has_value());
+static_assert(!empty_fixed.get(0).has_value());
+
+constexpr auto ten = create_fixed<16>(10);
+static_assert(ten.len() == 10);
+static_assert(ten.head().value() == 0);
+static_assert(ten.get(9).value() == 9);
+static_assert(!ten.get(10).has_value());
+
+// append fails, and changes nothing, once the list is full
+constexpr bool append_when_full() {
+    auto ll = create_fixed<2>(2);
+    return !ll.append(2) && ll.len() == 2;
+}
+static_assert(append_when_full());
+
+constexpr auto found = ten.find([](size_t idx, const int& elt) {
+    return elt > 4;
+});
+static_assert(found.has_value() && found.value() == 5);
+static_assert(!ten.find([](size_t idx, const int& elt) {
+    return elt > 100;
+}).has_value());
+
+constexpr auto squares = ten.map<long>([](size_t idx, const int& elt) {
+    return long(elt) * elt;
+});
+static_assert(squares.len() == 10);
+static_assert(squares.cap() == 16);
+static_assert(squares.get(7).value() == 49);
+
+static_assert(ten.reduce<int>(0, [](size_t idx, const int& acc, const int& elt) {
+    return acc + elt;
+}) == 45);
+
+constexpr bool for_each_visits_in_order() {
+    bool ok = true;
+    ten.forEach([&ok](size_t idx, const int& elt) {
+        ok = ok && (elt == int(idx));
+    });
+    return ok;
+}
+static_assert(for_each_visits_in_order());
+
+BOOST_AUTO_TEST_CASE(fixed_list_at_runtime) {
+    // the same API works on a list that isn't constexpr
+    auto ll = create_fixed<8>(3);
+    BOOST_TEST(ll.append(3));
+    BOOST_TEST(ll.len() == 4);
+    BOOST_TEST(ll.reduce<int>(0, [](size_t idx, const int& acc, const int& elt) {
+        return acc + elt;
+    }) == 6);
+}
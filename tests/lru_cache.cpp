@@ -0,0 +1,170 @@
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "lru_cache.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+BOOST_AUTO_TEST_CASE(lru_cache_empty) {
+    LRUCache<int, string> cache(3);
+    BOOST_TEST(cache.len() == 0);
+    BOOST_TEST(cache.cap() == 3);
+    BOOST_TEST(!cache.get(0).has_value());
+    BOOST_TEST(!cache.remove(0).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_put_and_get) {
+    LRUCache<int, string> cache(3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    BOOST_TEST(cache.len() == 2);
+    BOOST_TEST(cache.get(1).value() == "one");
+    BOOST_TEST(cache.get(2).value() == "two");
+
+    // putting an existing key replaces its value
+    // without growing the cache
+    cache.put(1, "uno");
+    BOOST_TEST(cache.len() == 2);
+    BOOST_TEST(cache.get(1).value() == "uno");
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_eviction_order) {
+    vector<pair<int, int>> evicted;
+    LRUCache<int, int> cache(3, [&evicted](const int& key, const int& val) {
+        evicted.push_back(make_pair(key, val));
+    });
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    // touch 1 so that 2 becomes the least recently used
+    cache.get(1);
+    // peek does not change recency, so 2 stays last
+    cache.peek(2);
+    cache.put(4, 40);
+
+    BOOST_TEST(cache.len() == 3);
+    BOOST_TEST(evicted.size() == 1);
+    BOOST_TEST(evicted.at(0).first == 2);
+    BOOST_TEST(evicted.at(0).second == 20);
+    BOOST_TEST(!cache.get(2).has_value());
+
+    cache.put(5, 50);
+    BOOST_TEST(evicted.size() == 2);
+    BOOST_TEST(evicted.at(1).first == 3);
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_remove) {
+    size_t num_evicted = 0;
+    LRUCache<int, int> cache(2, [&num_evicted](const int& key, const int& val) {
+        num_evicted++;
+    });
+    cache.put(1, 10);
+    cache.put(2, 20);
+    auto removed = cache.remove(1);
+    BOOST_TEST(removed.has_value());
+    BOOST_TEST(removed.value() == 10);
+    BOOST_TEST(cache.len() == 1);
+    BOOST_TEST(!cache.get(1).has_value());
+    // removing is not an eviction
+    BOOST_TEST(num_evicted == 0);
+
+    // there's room for 3 without evicting 2
+    cache.put(3, 30);
+    BOOST_TEST(num_evicted == 0);
+    BOOST_TEST(cache.get(2).value() == 20);
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_zero_capacity) {
+    LRUCache<int, int> cache(0);
+    cache.put(1, 10);
+    BOOST_TEST(cache.len() == 0);
+    BOOST_TEST(!cache.get(1).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(sharded_lru_cache_concurrent) {
+    const size_t num_threads = 4;
+    const int per_thread = 1000;
+    ShardedLRUCache<int, int> cache(8, num_threads * per_thread);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.push_back(thread([&cache, t, per_thread]() {
+            for (int i = 0; i < per_thread; ++i) {
+                const int key = int(t) * per_thread + i;
+                cache.put(key, key * 2);
+                cache.get(key);
+            }
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    // every shard is capped, so the total never exceeds cap
+    BOOST_TEST(cache.len() <= cache.cap());
+    BOOST_TEST(cache.len() > 0);
+    size_t found = 0;
+    for (int key = 0; key < int(num_threads) * per_thread; ++key) {
+        auto val = cache.peek(key);
+        if (val.has_value()) {
+            BOOST_TEST(val.value() == key * 2);
+            found++;
+        }
+    }
+    BOOST_TEST(found == cache.len());
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_throwing_evict_fn) {
+    LRUCache<int, string> cache(1, [](const int& key, const string& val) {
+        throw runtime_error("evict");
+    });
+    cache.put(1, "one");
+    BOOST_CHECK_THROW(cache.put(2, "two"), runtime_error);
+    // the evicted entry is gone, and the cache is still usable
+    BOOST_TEST(cache.len() == 0);
+    BOOST_TEST(!cache.get(1).has_value());
+    cache.put(3, "three");
+    BOOST_TEST(cache.get(3).value() == "three");
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_huge_capacity) {
+    // the index grows with the entries, so neither of these
+    // should allocate anything close to capacity up front
+    for (size_t capacity : {~size_t(0), size_t(1) << 40}) {
+        LRUCache<int, int> cache(capacity);
+        BOOST_TEST(cache.cap() == capacity);
+        for (int i = 0; i < 1000; ++i) {
+            cache.put(i, i * 2);
+        }
+        BOOST_TEST(cache.len() == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            BOOST_TEST(cache.get(i).value() == i * 2);
+        }
+    }
+
+    ShardedLRUCache<int, int> sharded(3, ~size_t(0));
+    BOOST_TEST(sharded.cap() == ~size_t(0));
+    sharded.put(1, 2);
+    BOOST_TEST(sharded.get(1).value() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(lru_cache_index_growth) {
+    // a capacity that isn't a power of two, filled past it,
+    // exercises growing and then evicting once the index
+    // has stopped growing
+    LRUCache<int, int> cache(100);
+    for (int i = 0; i < 300; ++i) {
+        cache.put(i, i);
+    }
+    BOOST_TEST(cache.len() == 100);
+    for (int i = 0; i < 200; ++i) {
+        BOOST_TEST(!cache.peek(i).has_value());
+    }
+    for (int i = 200; i < 300; ++i) {
+        BOOST_TEST(cache.peek(i).value() == i);
+    }
+}
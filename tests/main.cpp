@@ -1,7 +1,9 @@
 #define BOOST_TEST_MODULE LinkedList_Tests
 
+#include <cstdint>
 #include <iostream>
 #include <optional>
+#include <stdexcept>
 #include <string>
 
 #include <boost/test/included/unit_test.hpp>
@@ -280,3 +282,255 @@ BOOST_AUTO_TEST_CASE(zip_function) {
         });
     }
 }
+
+BOOST_AUTO_TEST_CASE(partitionInto_function) {
+    auto ll = create_ll(10);
+    LinkedList<int> buckets[3];
+    // bucket 0 starts off non-empty to check that moved
+    // nodes go after what's already there
+    buckets[0].append(-1);
+    ll->partitionInto(buckets, 3, [](size_t idx, const int& elt) {
+        return elt;
+    });
+    BOOST_TEST(ll->len() == 0);
+    BOOST_TEST(!ll->head().has_value());
+
+    vector<vector<int>> expected({
+        {-1, 0, 3, 6, 9},
+        {1, 4, 7},
+        {2, 5, 8},
+    });
+    for (size_t b = 0; b < expected.size(); ++b) {
+        BOOST_TEST(buckets[b].len() == expected.at(b).size());
+        buckets[b].forEach([&expected, b](size_t idx, const int& elt) {
+            BOOST_TEST(expected.at(b).at(idx) == elt);
+        });
+    }
+
+    // the moved nodes should still be usable as a normal list
+    buckets[1].append(10);
+    BOOST_TEST(buckets[1].len() == 4);
+    BOOST_TEST(buckets[1].get(3).value() == 10);
+}
+
+BOOST_AUTO_TEST_CASE(partitionInto_self_as_bucket) {
+    // partitioning a list into just itself leaves it as it was
+    auto ll = create_ll(10);
+    ll->partitionInto(ll.get(), 1, [](size_t idx, const int& elt) {
+        return 0;
+    });
+    BOOST_TEST(*ll == *create_ll(10));
+
+    // the source list can be one bucket among several
+    LinkedList<int> buckets[2];
+    buckets[0].append(create_ll(10));
+    buckets[0].partitionInto(buckets, 2, [](size_t idx, const int& elt) {
+        return elt % 2;
+    });
+    vector<vector<int>> expected({{0, 2, 4, 6, 8}, {1, 3, 5, 7, 9}});
+    for (size_t b = 0; b < expected.size(); ++b) {
+        BOOST_TEST(buckets[b].len() == expected.at(b).size());
+        buckets[b].forEach([&expected, b](size_t idx, const int& elt) {
+            BOOST_TEST(expected.at(b).at(idx) == elt);
+        });
+    }
+
+    // if fn throws, the unplaced nodes go back after the
+    // ones this list kept as its own bucket
+    auto ll2 = create_ll(10);
+    BOOST_CHECK_THROW(
+        ll2->partitionInto(ll2.get(), 1, [](size_t idx, const int& elt) -> size_t {
+            if (idx == 5) {
+                throw runtime_error("bucket");
+            }
+            return 0;
+        }),
+        runtime_error
+    );
+    BOOST_TEST(*ll2 == *create_ll(10));
+    ll2->append(10);
+    BOOST_TEST(*ll2 == *create_ll(11));
+}
+
+BOOST_AUTO_TEST_CASE(partitionInto_throwing_fn) {
+    auto ll = create_ll(10);
+    LinkedList<int> buckets[2];
+    BOOST_CHECK_THROW(
+        ll->partitionInto(buckets, 2, [](size_t idx, const int& elt) -> size_t {
+            if (idx == 5) {
+                throw runtime_error("bucket");
+            }
+            return 0;
+        }),
+        runtime_error
+    );
+    // everything not yet moved is still in the source list
+    BOOST_TEST(buckets[0].len() == 5);
+    BOOST_TEST(ll->len() == 5);
+    ll->forEach([](size_t idx, const int& elt) {
+        BOOST_TEST(elt == int(idx + 5));
+    });
+    ll->append(10);
+    BOOST_TEST(ll->len() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(zipInPlace_function) {
+    // zip a shorter list with a longer one
+    {
+        auto ll1 = create_ll(2);
+        auto ll2 = create_ll(3)->map<int>([](size_t idx, const int& elt) {
+            return idx + 1;
+        });
+        auto expected = ll1->zip(ll2);
+        ll1->zipInPlace(ll2);
+        BOOST_TEST(*ll1 == *expected);
+        BOOST_TEST(ll2->len() == 0);
+        ll1->append(4);
+        BOOST_TEST(ll1->len() == 6);
+    }
+    // zip a longer list with a shorter one
+    {
+        auto ll1 = create_ll(3)->map<int>([](size_t idx, const int& elt) {
+            return idx + 1;
+        });
+        auto ll2 = create_ll(2);
+        auto expected = ll1->zip(ll2);
+        ll1->zipInPlace(ll2);
+        BOOST_TEST(*ll1 == *expected);
+        BOOST_TEST(ll2->len() == 0);
+        ll1->append(4);
+        BOOST_TEST(ll1->len() == 6);
+    }
+    // zip an empty list with a non-empty one
+    {
+        auto ll1 = make_shared<LinkedList<int>>();
+        auto ll2 = create_ll(3);
+        ll1->zipInPlace(ll2);
+        BOOST_TEST(*ll1 == *create_ll(3));
+        BOOST_TEST(ll2->len() == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(forEachBatch_function) {
+    auto ll = create_ll(10);
+    vector<size_t> starts;
+    vector<size_t> sizes;
+    ll->forEachBatch(4, [&starts, &sizes](size_t idx, const int* elts, size_t n) {
+        starts.push_back(idx);
+        sizes.push_back(n);
+        for (size_t i = 0; i < n; ++i) {
+            BOOST_TEST(elts[i] == int(idx + i));
+        }
+    });
+    BOOST_TEST(starts == vector<size_t>({0, 4, 8}));
+    BOOST_TEST(sizes == vector<size_t>({4, 4, 2}));
+
+    // a batch size bigger than the list yields one batch
+    size_t num_batches = 0;
+    ll->forEachBatch(100, [&num_batches](size_t idx, const int* elts, size_t n) {
+        BOOST_TEST(n == 10);
+        num_batches++;
+    });
+    BOOST_TEST(num_batches == 1);
+
+    LinkedList<string> empty;
+    empty.forEachBatch(4, [](size_t idx, const string* elts, size_t n) {
+        BOOST_FAIL("forEachBatch called fn on an empty list");
+    });
+}
+
+BOOST_AUTO_TEST_CASE(forEachBatch_throwing_fn) {
+    LinkedList<string> ll;
+    for (size_t i = 0; i < 20; ++i) {
+        // long enough that each copy allocates
+        ll.append(string(64, char('a' + i)));
+    }
+    size_t calls = 0;
+    BOOST_CHECK_THROW(
+        ll.forEachBatch(8, [&calls](size_t idx, const string* elts, size_t n) {
+            if (++calls == 2) {
+                throw runtime_error("batch");
+            }
+        }),
+        runtime_error
+    );
+    BOOST_TEST(calls == 2);
+    BOOST_TEST(ll.len() == 20);
+}
+
+BOOST_AUTO_TEST_CASE(popN_throwing_move) {
+    // Picky throws when a value of 2 is moved into it
+    struct Picky {
+        int val;
+        Picky() = default;
+        explicit Picky(int val): val(val) {}
+        Picky(const Picky& other) = default;
+        Picky& operator=(const Picky& other) = default;
+        Picky& operator=(Picky&& other) {
+            if (other.val == 2) {
+                throw runtime_error("move");
+            }
+            this->val = other.val;
+            return *this;
+        }
+    };
+    LinkedList<Picky> ll;
+    for (int i = 0; i < 5; ++i) {
+        ll.append(Picky{i});
+    }
+    Picky out[5] = {};
+    BOOST_CHECK_THROW(ll.popN(out, 5), runtime_error);
+    // 0 and 1 were popped, and 2 stays in the list because
+    // its move threw
+    BOOST_TEST(out[1].val == 1);
+    BOOST_TEST(ll.len() == 3);
+    BOOST_TEST(ll.head().value().val == 2);
+}
+
+BOOST_AUTO_TEST_CASE(forEachBatch_overaligned) {
+    struct alignas(64) Wide {
+        int val;
+    };
+    LinkedList<Wide> ll;
+    for (int i = 0; i < 5; ++i) {
+        ll.append(Wide{i});
+    }
+    ll.forEachBatch(2, [](size_t idx, const Wide* elts, size_t n) {
+        BOOST_TEST(reinterpret_cast<uintptr_t>(elts) % alignof(Wide) == 0);
+        for (size_t i = 0; i < n; ++i) {
+            BOOST_TEST(elts[i].val == int(idx + i));
+        }
+    });
+}
+
+BOOST_AUTO_TEST_CASE(appendRange_function) {
+    auto ll = create_ll(2);
+    vector<int> elts({2, 3, 4});
+    ll->appendRange(elts.begin(), elts.end());
+    int arr[] = {5, 6};
+    ll->appendRange(arr, arr + 2);
+    BOOST_TEST(*ll == *create_ll(7));
+}
+
+BOOST_AUTO_TEST_CASE(popN_function) {
+    auto ll = create_ll(5);
+    int out[3];
+    BOOST_TEST(ll->popN(out, 3) == 3);
+    BOOST_TEST(out[0] == 0);
+    BOOST_TEST(out[1] == 1);
+    BOOST_TEST(out[2] == 2);
+    BOOST_TEST(ll->len() == 2);
+    BOOST_TEST(ll->head().value() == 3);
+
+    // asking for more than is left pops what's there
+    BOOST_TEST(ll->popN(out, 3) == 2);
+    BOOST_TEST(out[0] == 3);
+    BOOST_TEST(out[1] == 4);
+    BOOST_TEST(ll->len() == 0);
+    BOOST_TEST(ll->popN(out, 3) == 0);
+
+    // the list is still usable after being drained
+    ll->append(7);
+    BOOST_TEST(ll->len() == 1);
+    BOOST_TEST(ll->head().value() == 7);
+}
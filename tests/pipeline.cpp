@@ -0,0 +1,139 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include "ll.hpp"
+#include "ll_printer.hpp"
+#include "ll_util.hpp"
+#include "pipeline.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// can_filter is true if filter can be called on a P. stages
+// and terminal operations consume a pipeline, so they should
+// only be callable on rvalues.
+template <typename P, typename = void>
+struct can_filter : false_type {};
+
+template <typename P>
+struct can_filter<P, void_t<decltype(declval<P>().filter(declval<find_fn<int>>()))>> : true_type {};
+
+static_assert(can_filter<Pipeline<int>>::value);
+static_assert(!can_filter<Pipeline<int>&>::value);
+
+BOOST_AUTO_TEST_CASE(pipeline_matches_sequential_chain) {
+    auto ll = create_ll(1000);
+    auto times3 = [](size_t idx, int elt) {
+        return elt * 3;
+    };
+    auto isEven = [](size_t idx, const int& elt) {
+        return elt % 2 == 0;
+    };
+    auto withIdx = [](size_t idx, const int& elt) {
+        auto ret = make_shared<LinkedList<int>>();
+        ret->append(elt);
+        ret->append(int(idx));
+        return ret;
+    };
+    auto expected = ll->map<int>(times3)->filter(isEven)->flatMap<int>(withIdx);
+
+    // a depth of 1 forces every value through the queues
+    // one at a time
+    for (size_t depth : {1, 7, 4096}) {
+        auto collected = Pipeline<int>::from(ll, depth)
+            .map<int>(times3)
+            .filter(isEven)
+            .flatMap<int>(withIdx)
+            .collect();
+        BOOST_TEST(*collected == *expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_reduce) {
+    auto ll = create_ll(100);
+    auto reduced = Pipeline<int>::from(ll, 8)
+        .map<string>([](size_t idx, int elt) {
+            return to_string(elt);
+        })
+        .reduce<size_t>(0, [](size_t idx, const size_t& acc, const string& elt) {
+            return acc + elt.size();
+        });
+    // 10 one digit numbers and 90 two digit numbers
+    BOOST_TEST(reduced == size_t(10 + 90 * 2));
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_empty_list) {
+    auto ll = make_shared<LinkedList<int>>();
+    auto collected = Pipeline<int>::from(ll, 4)
+        .filter([](size_t idx, const int& elt) {
+            return true;
+        })
+        .collect();
+    BOOST_TEST(collected->len() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_dropped_before_completion) {
+    // none of these pipelines are ever drained, so their
+    // stages block on full queues. destroying them has to
+    // cancel the stages rather than hang.
+    auto ll = create_ll(10000);
+    {
+        auto p = Pipeline<int>::from(ll, 2);
+    }
+    {
+        auto p = Pipeline<int>::from(ll, 2)
+            .map<int>([](size_t idx, int elt) {
+                return elt + 1;
+            })
+            .filter([](size_t idx, const int& elt) {
+                return true;
+            });
+    }
+    BOOST_TEST(ll->len() == 10000);
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_stage_throws) {
+    // the list is much bigger than the queues, so the stages
+    // before the one that throws are blocked on full queues
+    // and have to be cancelled
+    auto ll = create_ll(10000);
+    for (size_t depth : {1, 16}) {
+        auto run = [ll, depth]() {
+            return Pipeline<int>::from(ll, depth)
+                .map<int>([](size_t idx, int elt) {
+                    return elt;
+                })
+                .filter([](size_t idx, const int& elt) {
+                    if (idx == 500) {
+                        throw runtime_error("filter");
+                    }
+                    return true;
+                })
+                .map<int>([](size_t idx, int elt) {
+                    return elt;
+                })
+                .collect();
+        };
+        BOOST_CHECK_THROW(run(), runtime_error);
+    }
+    BOOST_TEST(ll->len() == 10000);
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_reduce_fn_throws) {
+    auto ll = create_ll(10000);
+    auto run = [ll]() {
+        return Pipeline<int>::from(ll, 4)
+            .filter([](size_t idx, const int& elt) {
+                return true;
+            })
+            .reduce<int>(0, [](size_t idx, const int& acc, const int& elt) -> int {
+                throw runtime_error("reduce");
+            });
+    };
+    BOOST_CHECK_THROW(run(), runtime_error);
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "sorted_ll.hpp"
+
+using namespace std;
+using namespace linkedlist;
+
+// create_sorted creates a new sorted list by inserting
+// each of elts, in order
+shared_ptr<SortedLinkedList<int>> create_sorted(const vector<int>& elts) {
+    auto ll = make_shared<SortedLinkedList<int>>();
+    for (auto elt : elts) {
+        ll->insert(elt);
+    }
+    return ll;
+}
+
+// check_sorted checks that ll holds exactly expected,
+// in order
+void check_sorted(const shared_ptr<SortedLinkedList<int>> ll, const vector<int>& expected) {
+    BOOST_TEST(ll->len() == expected.size());
+    ll->forEach([&expected](size_t idx, const int& elt) {
+        BOOST_TEST(expected.at(idx) == elt);
+    });
+    // inserting a value bigger than everything has to land
+    // at the end, which only works if last is right
+    ll->insert(1000);
+    BOOST_TEST(ll->reduce<int>(0, [](size_t idx, const int& acc, const int& elt) {
+        return elt;
+    }) == 1000);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_insert) {
+    auto ll = create_sorted({5, 1, 4, 2, 3, 0, 6});
+    check_sorted(ll, {0, 1, 2, 3, 4, 5, 6});
+    BOOST_TEST(ll->contains(3));
+    BOOST_TEST(!ll->contains(7));
+    BOOST_TEST(ll->head().value() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_insert_near_sorted) {
+    // mostly ascending, with values that land just behind
+    // the previous insert to exercise the galloping search
+    vector<int> elts;
+    vector<int> expected;
+    for (int i = 0; i < 200; ++i) {
+        elts.push_back(i % 10 == 9 ? i - 5 : i);
+    }
+    expected = elts;
+    sort(expected.begin(), expected.end());
+    check_sorted(create_sorted(elts), expected);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_custom_comparator) {
+    SortedLinkedList<int, greater<int>> ll;
+    ll.insert(1);
+    ll.insert(3);
+    ll.insert(2);
+    vector<int> expected({3, 2, 1});
+    ll.forEach([&expected](size_t idx, const int& elt) {
+        BOOST_TEST(expected.at(idx) == elt);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(sorted_pop) {
+    auto ll = create_sorted({2, 1});
+    BOOST_TEST(ll->pop().value() == 1);
+    BOOST_TEST(ll->pop().value() == 2);
+    BOOST_TEST(!ll->pop().has_value());
+    BOOST_TEST(ll->len() == 0);
+    ll->insert(3);
+    BOOST_TEST(ll->head().value() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_dedup) {
+    auto ll = create_sorted({1, 1, 2, 3, 3, 3, 4, 4});
+    ll->dedup();
+    check_sorted(ll, {1, 2, 3, 4});
+}
+
+BOOST_AUTO_TEST_CASE(sorted_union) {
+    auto ll1 = create_sorted({1, 3, 5, 7});
+    auto ll2 = create_sorted({2, 3, 4, 7, 8, 9});
+    ll1->unionWith(ll2);
+    BOOST_TEST(ll2->len() == 0);
+    check_sorted(ll1, {1, 2, 3, 4, 5, 7, 8, 9});
+
+    // union with an empty list, and into an empty list
+    auto empty = make_shared<SortedLinkedList<int>>();
+    auto ll3 = create_sorted({1, 2});
+    ll3->unionWith(empty);
+    check_sorted(ll3, {1, 2});
+    auto ll4 = create_sorted({1, 2});
+    empty->unionWith(ll4);
+    check_sorted(empty, {1, 2});
+}
+
+BOOST_AUTO_TEST_CASE(sorted_intersect) {
+    auto ll1 = create_sorted({1, 2, 3, 5, 7, 9});
+    auto ll2 = create_sorted({0, 2, 3, 4, 9, 10});
+    ll1->intersect(ll2);
+    BOOST_TEST(ll2->len() == 6);
+    check_sorted(ll1, {2, 3, 9});
+
+    auto ll3 = create_sorted({1, 2});
+    ll3->intersect(make_shared<SortedLinkedList<int>>());
+    check_sorted(ll3, {});
+}
+
+BOOST_AUTO_TEST_CASE(sorted_difference) {
+    auto ll1 = create_sorted({1, 2, 3, 5, 7, 9});
+    auto ll2 = create_sorted({0, 2, 3, 4, 9, 10});
+    ll1->difference(ll2);
+    BOOST_TEST(ll2->len() == 6);
+    check_sorted(ll1, {1, 5, 7});
+
+    ll1->difference(ll1);
+    check_sorted(ll1, {});
+}
+
+BOOST_AUTO_TEST_CASE(sorted_insert_after_set_operations) {
+    // set operations relink nodes, so inserting into the
+    // middle afterward checks that both directions of
+    // links were kept consistent
+    auto ll1 = create_sorted({0, 10, 20, 30, 40});
+    ll1->unionWith(create_sorted({5, 15, 25}));
+    ll1->difference(create_sorted({10, 30}));
+    ll1->intersect(create_sorted({0, 5, 15, 20, 25, 40}));
+    for (int elt : {24, 1, 16, 6, 39}) {
+        ll1->insert(elt);
+    }
+    check_sorted(ll1, {0, 1, 5, 6, 15, 16, 20, 24, 25, 39, 40});
+}
+
+// SortedLinkedList owns raw nodes, so assigning one to
+// another must not compile
+static_assert(!is_copy_assignable<SortedLinkedList<int>>::value);